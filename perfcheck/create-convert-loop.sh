@@ -1,14 +1,13 @@
 #!/bin/sh
 
+# convert all the AliESDs.root files into one single compact.root,
+# using forked worker processes (see ConvertESDList in QuickAccEff.C ;
+# the 0 passed as nworkers means one worker per hardware thread).
+# If interrupted, change the last argument of ConvertESDList to kTRUE
+# to resume the conversion.
+
+echo "find /alice/cern.ch/user/l/laphecet/simulations/idealpp13/ -name AliESDs.root > esdlist.txt"
 echo "root -b <<EOF"
 echo ".L QuickAccEff.C+"
-
-for file in $(find /alice/cern.ch/user/l/laphecet/simulations/idealpp13/ -name AliESDs.root)
-do
-    dest=${file/AliESDs/compact}
-    list="$list $dest"
-    echo "ConvertESD(\"$file\",\"$dest\",\"local:///alice/data/2015/OCDB\");"
-done
+echo "ConvertESDList(\"esdlist.txt\",\"compact.root\",\"local:///alice/data/2015/OCDB\",0,kFALSE);"
 echo "EOF"
-echo hadd -f compact.root $list
-